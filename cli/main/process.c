@@ -0,0 +1,82 @@
+// Minimal process pool support for `wasmoon test --jobs N`.
+// The MoonBit runtime is single-threaded, so parallel test runs fork one
+// worker process per WAST file.
+
+#include <moonbit.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+
+MOONBIT_FFI_EXPORT int32_t wasmoon_proc_fork(int32_t timeout_sec) {
+  (void)timeout_sec;
+  return -1;
+}
+
+MOONBIT_FFI_EXPORT int32_t wasmoon_proc_wait_any(int32_t *status_out) {
+  status_out[0] = -1;
+  return -1;
+}
+
+MOONBIT_FFI_EXPORT void wasmoon_proc_exit(int32_t code) {
+  fflush(stdout);
+  fflush(stderr);
+  exit(code);
+}
+
+#else
+
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Fork a worker. In the child, arm an alarm so a hung test file is killed
+// after `timeout_sec` seconds (0 = no limit). Returns the child's pid in the
+// parent, 0 in the child and -1 on failure.
+MOONBIT_FFI_EXPORT int32_t wasmoon_proc_fork(int32_t timeout_sec) {
+  // Don't let the child inherit (and later flush a second time) buffered output.
+  fflush(stdout);
+  fflush(stderr);
+  pid_t pid = fork();
+  if (pid == 0 && timeout_sec > 0) {
+    alarm((unsigned)timeout_sec);
+  }
+  return (int32_t)pid;
+}
+
+// Wait for any child. Returns its pid (-1 if there are none) and stores its
+// exit code in status_out[0], or -signal if it was killed by a signal.
+MOONBIT_FFI_EXPORT int32_t wasmoon_proc_wait_any(int32_t *status_out) {
+  int status = 0;
+  pid_t pid;
+  do {
+    pid = waitpid(-1, &status, 0);
+  } while (pid < 0 && errno == EINTR);
+  if (pid < 0) {
+    status_out[0] = -1;
+    return -1;
+  }
+  if (WIFEXITED(status)) {
+    status_out[0] = WEXITSTATUS(status);
+  } else if (WIFSIGNALED(status)) {
+    status_out[0] = -WTERMSIG(status);
+  } else {
+    status_out[0] = -1;
+  }
+  return (int32_t)pid;
+}
+
+// Leave a worker without running the parent's atexit handlers.
+MOONBIT_FFI_EXPORT void wasmoon_proc_exit(int32_t code) {
+  fflush(stdout);
+  fflush(stderr);
+  _exit(code);
+}
+
+#endif
+
+// Remove a file; `path` is NUL-terminated UTF-8.
+MOONBIT_FFI_EXPORT int32_t wasmoon_proc_remove(moonbit_bytes_t path) {
+  return remove((const char *)path);
+}
@@ -0,0 +1,48 @@
+;; Deep adapter chains: a leaf component's `f` is re-exported through four
+;; forwarding components, each of which lowers its import and lifts it again.
+;; Every driver call therefore crosses five lift/lower boundaries.
+;;
+;; Driven by scripts/bench_component_calls.py.
+(component
+  (component $Leaf
+    (core module $M
+      (func (export "f") (param i32) (result i32) (i32.add (local.get 0) (i32.const 1))))
+    (core instance $m (instantiate $M))
+    (func (export "f") (param "x" u32) (result u32) (canon lift (core func $m "f")))
+  )
+  (component $Hop
+    (import "f" (func $f (param "x" u32) (result u32)))
+    (core func $f' (canon lower (func $f)))
+    (core module $M
+      (import "" "f" (func $f (param i32) (result i32)))
+      (func (export "f") (param i32) (result i32) (call $f (local.get 0))))
+    (core instance $m (instantiate $M (with "" (instance
+      (export "f" (func $f'))
+    ))))
+    (func (export "f") (param "x" u32) (result u32) (canon lift (core func $m "f")))
+  )
+  (instance $leaf (instantiate $Leaf))
+  (instance $h1 (instantiate $Hop (with "f" (func $leaf "f"))))
+  (instance $h2 (instantiate $Hop (with "f" (func $h1 "f"))))
+  (instance $h3 (instantiate $Hop (with "f" (func $h2 "f"))))
+  (instance $h4 (instantiate $Hop (with "f" (func $h3 "f"))))
+  (core func $f (canon lower (func $h4 "f")))
+  (core module $Driver
+    (import "" "f" (func $f (param i32) (result i32)))
+    (func (export "run") (param $iters i32) (result i32)
+      (local $i i32)
+      (block $done
+        (loop $continue
+          (br_if $done (i32.ge_u (local.get $i) (local.get $iters)))
+          (if (i32.ne (call $f (local.get $i)) (i32.add (local.get $i) (i32.const 1)))
+            (then unreachable))
+          (local.set $i (i32.add (local.get $i) (i32.const 1)))
+          (br $continue)))
+      (local.get $i))
+  )
+  (core instance $d (instantiate $Driver (with "" (instance
+    (export "f" (func $f))
+  ))))
+  (func (export "run") (param "iters" u32) (result u32) (canon lift (core func $d "run")))
+)
+(assert_return (invoke "run" (u32.const 1000)) (u32.const 1000))
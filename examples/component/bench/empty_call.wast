@@ -0,0 +1,30 @@
+;; Cross-component call overhead: `run` calls an empty exported function of a
+;; nested component `iters` times through `canon lower` / `canon lift`.
+;;
+;; Driven by scripts/bench_component_calls.py.
+(component
+  (component $Callee
+    (core module $M (func (export "f")))
+    (core instance $m (instantiate $M))
+    (func (export "f") (canon lift (core func $m "f")))
+  )
+  (instance $callee (instantiate $Callee))
+  (core func $f (canon lower (func $callee "f")))
+  (core module $Driver
+    (import "" "f" (func $f))
+    (func (export "run") (param $iters i32) (result i32)
+      (local $i i32)
+      (block $done
+        (loop $continue
+          (br_if $done (i32.ge_u (local.get $i) (local.get $iters)))
+          (call $f)
+          (local.set $i (i32.add (local.get $i) (i32.const 1)))
+          (br $continue)))
+      (local.get $i))
+  )
+  (core instance $d (instantiate $Driver (with "" (instance
+    (export "f" (func $f))
+  ))))
+  (func (export "run") (param "iters" u32) (result u32) (canon lift (core func $d "run")))
+)
+(assert_return (invoke "run" (u32.const 1000)) (u32.const 1000))
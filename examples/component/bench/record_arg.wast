@@ -0,0 +1,58 @@
+;; Call overhead with a record argument holding a scalar, a string and a
+;; list<u8>, both of `size` bytes. The callee returns the sum of the two
+;; lengths it received.
+;;
+;; Driven by scripts/bench_component_calls.py.
+(component
+  (component $Callee
+    (type $Req (record (field "id" u32) (field "name" string) (field "payload" (list u8))))
+    (export $Req' "req" (type $Req))
+    (core module $M
+      (memory (export "mem") 3)
+      ;; Arguments are dead once the call returns; bump within one call only.
+      (global $next (mut i32) (i32.const 16))
+      (func (export "realloc") (param i32 i32 i32 i32) (result i32)
+        (local $p i32)
+        (local.set $p (global.get $next))
+        (global.set $next (i32.add (local.get $p) (local.get 3)))
+        (local.get $p))
+      (func (export "f") (param $id i32) (param $name i32) (param $name_len i32)
+                         (param $payload i32) (param $payload_len i32) (result i32)
+        (global.set $next (i32.const 16))
+        (i32.add (local.get $name_len) (local.get $payload_len)))
+    )
+    (core instance $m (instantiate $M))
+    (func (export "f") (param "req" $Req') (result u32)
+      (canon lift (core func $m "f") (memory $m "mem") (realloc (func $m "realloc"))))
+  )
+  (instance $callee (instantiate $Callee))
+  (core module $Memory (memory (export "mem") 2))
+  (core instance $memory (instantiate $Memory))
+  (core func $f (canon lower (func $callee "f") (memory $memory "mem")))
+  (core module $Driver
+    (import "" "mem" (memory 2))
+    (import "" "f" (func $f (param i32 i32 i32 i32 i32) (result i32)))
+    (func (export "run") (param $iters i32) (param $size i32) (result i32)
+      (local $i i32)
+      (memory.fill (i32.const 0) (i32.const 0x61) (local.get $size))
+      (block $done
+        (loop $continue
+          (br_if $done (i32.ge_u (local.get $i) (local.get $iters)))
+          (if (i32.ne
+                (call $f (local.get $i)
+                  (i32.const 0) (local.get $size)
+                  (i32.const 0) (local.get $size))
+                (i32.shl (local.get $size) (i32.const 1)))
+            (then unreachable))
+          (local.set $i (i32.add (local.get $i) (i32.const 1)))
+          (br $continue)))
+      (local.get $i))
+  )
+  (core instance $d (instantiate $Driver (with "" (instance
+    (export "mem" (memory $memory "mem"))
+    (export "f" (func $f))
+  ))))
+  (func (export "run") (param "iters" u32) (param "size" u32) (result u32)
+    (canon lift (core func $d "run")))
+)
+(assert_return (invoke "run" (u32.const 1000) (u32.const 64)) (u32.const 1000))
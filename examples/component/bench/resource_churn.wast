@@ -0,0 +1,53 @@
+;; Resource churn: each iteration calls the callee's constructor, which mints an
+;; `own<r>` handle with `resource.new`, and the driver drops it again with
+;; `resource.drop`, running the callee's destructor.
+;;
+;; Driven by scripts/bench_component_calls.py.
+(component
+  (component $Callee
+    (core module $Dtor
+      (global $dropped (export "dropped") (mut i32) (i32.const 0))
+      (func (export "dtor") (param i32)
+        (global.set $dropped (i32.add (global.get $dropped) (i32.const 1))))
+    )
+    (core instance $dtor (instantiate $Dtor))
+    (type $R (resource (rep i32) (dtor (func $dtor "dtor"))))
+    (export $R' "r" (type $R))
+    (core func $new (canon resource.new $R))
+    (core module $M
+      (import "" "new" (func $new (param i32) (result i32)))
+      (global $next (mut i32) (i32.const 0))
+      (func (export "make") (result i32)
+        (global.set $next (i32.add (global.get $next) (i32.const 1)))
+        (call $new (global.get $next)))
+    )
+    (core instance $m (instantiate $M (with "" (instance
+      (export "new" (func $new))
+    ))))
+    (func (export "[constructor]r") (result (own $R'))
+      (canon lift (core func $m "make")))
+  )
+  (instance $callee (instantiate $Callee))
+  (alias export $callee "r" (type $R))
+  (core func $make (canon lower (func $callee "[constructor]r")))
+  (core func $drop (canon resource.drop $R))
+  (core module $Driver
+    (import "" "make" (func $make (result i32)))
+    (import "" "drop" (func $drop (param i32)))
+    (func (export "run") (param $iters i32) (result i32)
+      (local $i i32)
+      (block $done
+        (loop $continue
+          (br_if $done (i32.ge_u (local.get $i) (local.get $iters)))
+          (call $drop (call $make))
+          (local.set $i (i32.add (local.get $i) (i32.const 1)))
+          (br $continue)))
+      (local.get $i))
+  )
+  (core instance $d (instantiate $Driver (with "" (instance
+    (export "make" (func $make))
+    (export "drop" (func $drop))
+  ))))
+  (func (export "run") (param "iters" u32) (result u32) (canon lift (core func $d "run")))
+)
+(assert_return (invoke "run" (u32.const 1000)) (u32.const 1000))
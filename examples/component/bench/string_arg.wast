@@ -0,0 +1,45 @@
+;; Call overhead with a `string` argument of `size` bytes. Every call copies
+;; the string from the driver's memory into the callee's memory through the
+;; callee's `realloc`; the callee returns the byte length it received.
+;;
+;; Driven by scripts/bench_component_calls.py.
+(component
+  (component $Callee
+    (core module $M
+      (memory (export "mem") 2)
+      ;; Arguments are dead once the call returns, so every allocation reuses
+      ;; the same scratch region.
+      (func (export "realloc") (param i32 i32 i32 i32) (result i32) (i32.const 16))
+      (func (export "f") (param $ptr i32) (param $len i32) (result i32) (local.get $len))
+    )
+    (core instance $m (instantiate $M))
+    (func (export "f") (param "s" string) (result u32)
+      (canon lift (core func $m "f") (memory $m "mem") (realloc (func $m "realloc"))))
+  )
+  (instance $callee (instantiate $Callee))
+  (core module $Memory (memory (export "mem") 2))
+  (core instance $memory (instantiate $Memory))
+  (core func $f (canon lower (func $callee "f") (memory $memory "mem")))
+  (core module $Driver
+    (import "" "mem" (memory 2))
+    (import "" "f" (func $f (param i32 i32) (result i32)))
+    (func (export "run") (param $iters i32) (param $size i32) (result i32)
+      (local $i i32)
+      (memory.fill (i32.const 0) (i32.const 0x61) (local.get $size))
+      (block $done
+        (loop $continue
+          (br_if $done (i32.ge_u (local.get $i) (local.get $iters)))
+          (if (i32.ne (call $f (i32.const 0) (local.get $size)) (local.get $size))
+            (then unreachable))
+          (local.set $i (i32.add (local.get $i) (i32.const 1)))
+          (br $continue)))
+      (local.get $i))
+  )
+  (core instance $d (instantiate $Driver (with "" (instance
+    (export "mem" (memory $memory "mem"))
+    (export "f" (func $f))
+  ))))
+  (func (export "run") (param "iters" u32) (param "size" u32) (result u32)
+    (canon lift (core func $d "run")))
+)
+(assert_return (invoke "run" (u32.const 1000) (u32.const 1024)) (u32.const 1000))
@@ -0,0 +1,113 @@
+;; Throughput benchmark for chained `stream<u8>` copies.
+;;
+;; A single component pushes 64 KiB chunks through a chain of four streams.
+;; Each hop issues an async `stream.write` that blocks (lending its buffer to
+;; the stream), then a `stream.read` that completes by copying straight out of
+;; the writer's buffer, then waits for the STREAM_WRITE completion event.
+;;
+;; `run` takes the number of chunks; every chunk crosses all four hops, so the
+;; total number of bytes moved is `iters * 4 * 65536`.
+;;
+;; Driven by scripts/bench_component_streams.py.
+(component
+  (core module $Memory (memory (export "mem") 8))
+  (core instance $memory (instantiate $Memory))
+  (core module $M
+    (import "" "mem" (memory 8))
+    (import "" "waitable.join" (func $waitable.join (param i32 i32)))
+    (import "" "waitable-set.new" (func $waitable-set.new (result i32)))
+    (import "" "waitable-set.wait" (func $waitable-set.wait (param i32 i32) (result i32)))
+    (import "" "stream.new" (func $stream.new (result i64)))
+    (import "" "stream.read" (func $stream.read (param i32 i32 i32) (result i32)))
+    (import "" "stream.write" (func $stream.write (param i32 i32 i32) (result i32)))
+    (import "" "stream.drop-readable" (func $stream.drop-readable (param i32)))
+    (import "" "stream.drop-writable" (func $stream.drop-writable (param i32)))
+
+    ;; Chunk size in bytes; stage buffer N lives at (N + 1) * $chunk.
+    (global $chunk i32 (i32.const 0x10000))
+
+    ;; Move one chunk from $src to $dst through the stream pair $tx/$rx.
+    (func $hop (param $tx i32) (param $rx i32) (param $src i32) (param $dst i32) (param $ws i32)
+      (local $ret i32)
+      (local.set $ret (call $stream.write (local.get $tx) (local.get $src) (global.get $chunk)))
+      (if (i32.ne (i32.const -1 (; BLOCKED ;)) (local.get $ret))
+        (then unreachable))
+      (local.set $ret (call $stream.read (local.get $rx) (local.get $dst) (global.get $chunk)))
+      (if (i32.ne (i32.shl (global.get $chunk) (i32.const 4)) (local.get $ret))
+        (then unreachable))
+      (if (i32.ne (i32.const 3 (; STREAM_WRITE ;)) (call $waitable-set.wait (local.get $ws) (i32.const 0)))
+        (then unreachable))
+      (if (i32.ne (local.get $tx) (i32.load (i32.const 0)))
+        (then unreachable))
+    )
+
+    (func $run (export "run") (param $iters i32) (result i32)
+      (local $ret64 i64) (local $ws i32) (local $i i32)
+      (local $rx0 i32) (local $tx0 i32) (local $rx1 i32) (local $tx1 i32)
+      (local $rx2 i32) (local $tx2 i32) (local $rx3 i32) (local $tx3 i32)
+
+      (local.set $ws (call $waitable-set.new))
+      (local.set $ret64 (call $stream.new))
+      (local.set $rx0 (i32.wrap_i64 (local.get $ret64)))
+      (local.set $tx0 (i32.wrap_i64 (i64.shr_u (local.get $ret64) (i64.const 32))))
+      (local.set $ret64 (call $stream.new))
+      (local.set $rx1 (i32.wrap_i64 (local.get $ret64)))
+      (local.set $tx1 (i32.wrap_i64 (i64.shr_u (local.get $ret64) (i64.const 32))))
+      (local.set $ret64 (call $stream.new))
+      (local.set $rx2 (i32.wrap_i64 (local.get $ret64)))
+      (local.set $tx2 (i32.wrap_i64 (i64.shr_u (local.get $ret64) (i64.const 32))))
+      (local.set $ret64 (call $stream.new))
+      (local.set $rx3 (i32.wrap_i64 (local.get $ret64)))
+      (local.set $tx3 (i32.wrap_i64 (i64.shr_u (local.get $ret64) (i64.const 32))))
+      (call $waitable.join (local.get $tx0) (local.get $ws))
+      (call $waitable.join (local.get $tx1) (local.get $ws))
+      (call $waitable.join (local.get $tx2) (local.get $ws))
+      (call $waitable.join (local.get $tx3) (local.get $ws))
+
+      (memory.fill (i32.const 0x10000) (i32.const 42) (global.get $chunk))
+      (loop $continue
+        (if (i32.lt_u (local.get $i) (local.get $iters))
+          (then
+            (call $hop (local.get $tx0) (local.get $rx0) (i32.const 0x10000) (i32.const 0x20000) (local.get $ws))
+            (call $hop (local.get $tx1) (local.get $rx1) (i32.const 0x20000) (i32.const 0x30000) (local.get $ws))
+            (call $hop (local.get $tx2) (local.get $rx2) (i32.const 0x30000) (i32.const 0x40000) (local.get $ws))
+            (call $hop (local.get $tx3) (local.get $rx3) (i32.const 0x40000) (i32.const 0x50000) (local.get $ws))
+            (local.set $i (i32.add (local.get $i) (i32.const 1)))
+            (br $continue))))
+
+      (call $stream.drop-writable (local.get $tx0))
+      (call $stream.drop-readable (local.get $rx0))
+      (call $stream.drop-writable (local.get $tx1))
+      (call $stream.drop-readable (local.get $rx1))
+      (call $stream.drop-writable (local.get $tx2))
+      (call $stream.drop-readable (local.get $rx2))
+      (call $stream.drop-writable (local.get $tx3))
+      (call $stream.drop-readable (local.get $rx3))
+
+      ;; the last byte of the final stage must have made it through every hop
+      (i32.load8_u (i32.const 0x5ffff))
+    )
+  )
+  (type $ST (stream u8))
+  (canon waitable.join (core func $waitable.join))
+  (canon waitable-set.new (core func $waitable-set.new))
+  (canon waitable-set.wait (memory $memory "mem") (core func $waitable-set.wait))
+  (canon stream.new $ST (core func $stream.new))
+  (canon stream.read $ST async (memory $memory "mem") (core func $stream.read))
+  (canon stream.write $ST async (memory $memory "mem") (core func $stream.write))
+  (canon stream.drop-readable $ST (core func $stream.drop-readable))
+  (canon stream.drop-writable $ST (core func $stream.drop-writable))
+  (core instance $m (instantiate $M (with "" (instance
+    (export "mem" (memory $memory "mem"))
+    (export "waitable.join" (func $waitable.join))
+    (export "waitable-set.new" (func $waitable-set.new))
+    (export "waitable-set.wait" (func $waitable-set.wait))
+    (export "stream.new" (func $stream.new))
+    (export "stream.read" (func $stream.read))
+    (export "stream.write" (func $stream.write))
+    (export "stream.drop-readable" (func $stream.drop-readable))
+    (export "stream.drop-writable" (func $stream.drop-writable))
+  ))))
+  (func (export "run") async (param "iters" u32) (result u32) (canon lift (core func $m "run")))
+)
+(assert_return (invoke "run" (u32.const 64)) (u32.const 42))
@@ -1106,6 +1106,15 @@ MOONBIT_FFI_EXPORT int wasmoon_mem_desc_memmove(int64_t mem_desc_ptr, int64_t ds
     return 0;
 }
 
+MOONBIT_FFI_EXPORT int wasmoon_mem_desc_copy(int64_t dst_desc_ptr, int64_t dst, int64_t src_desc_ptr, int64_t src, int size) {
+    wasmoon_memory_t *dst_mem = (wasmoon_memory_t *)dst_desc_ptr;
+    wasmoon_memory_t *src_mem = (wasmoon_memory_t *)src_desc_ptr;
+    if (!dst_mem || !dst_mem->base || !src_mem || !src_mem->base || size <= 0) return -1;
+    // memmove: both descriptors may alias the same backing store.
+    memmove(dst_mem->base + dst, src_mem->base + src, (size_t)size);
+    return 0;
+}
+
 MOONBIT_FFI_EXPORT int wasmoon_mem_desc_memset(int64_t mem_desc_ptr, int64_t dst, int32_t val, int size) {
     wasmoon_memory_t *mem = (wasmoon_memory_t *)mem_desc_ptr;
     if (!mem || !mem->base || size <= 0) return -1;
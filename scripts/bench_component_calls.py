@@ -0,0 +1,261 @@
+#!/usr/bin/env python3
+"""Measure component-model call overhead on the examples/component/bench suite.
+
+Each workload exports `run(iters, ...)`, which performs `iters` operations
+across a component boundary. Every case is timed at two iteration counts and
+the per-operation cost is the slope between them, so parsing, validation,
+instantiation and process start-up cancel out.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import platform
+import re
+import statistics
+import sys
+import tempfile
+import time
+from pathlib import Path
+from typing import Any, Dict, List, Tuple
+
+sys.path.insert(0, str(Path(__file__).resolve().parent))
+
+from run_component_wast import run_file  # noqa: E402
+
+BENCH_DIR = "examples/component/bench"
+
+# (case name, workload, extra `run` args, expected result or None for `iters`)
+CASES: List[Tuple[str, str, List[int], int | None]] = [
+    ("empty-call", f"{BENCH_DIR}/empty_call.wast", [], None),
+    ("string-16", f"{BENCH_DIR}/string_arg.wast", [16], None),
+    ("string-1k", f"{BENCH_DIR}/string_arg.wast", [1024], None),
+    ("string-16k", f"{BENCH_DIR}/string_arg.wast", [16384], None),
+    ("list-u8-16", f"{BENCH_DIR}/list_u8_arg.wast", [16], None),
+    ("list-u8-1k", f"{BENCH_DIR}/list_u8_arg.wast", [1024], None),
+    ("list-u8-16k", f"{BENCH_DIR}/list_u8_arg.wast", [16384], None),
+    ("record-64", f"{BENCH_DIR}/record_arg.wast", [64], None),
+    ("record-4k", f"{BENCH_DIR}/record_arg.wast", [4096], None),
+    ("resource-churn", f"{BENCH_DIR}/resource_churn.wast", [], None),
+    ("adapter-chain-5", f"{BENCH_DIR}/adapter_chain.wast", [], None),
+    # One operation is a 64 KiB chunk crossing four async stream hops.
+    ("async-stream-chain", "examples/component/stream_chain.wast", [], 42),
+]
+
+RUN_ASSERT = re.compile(r'^\(assert_return \(invoke "run".*$', re.MULTILINE)
+
+
+def _u32_args(values: List[int]) -> str:
+    return " ".join(f"(u32.const {v})" for v in values)
+
+
+def _materialize(
+    repo_root: Path,
+    tmp: Path,
+    workload: str,
+    iters: int,
+    extra: List[int],
+    expected: int | None,
+) -> Path:
+    """Copy `workload` into `tmp` with its `run` assertion rewritten for `iters`."""
+    text = (repo_root / workload).read_text(encoding="utf-8")
+    result = iters if expected is None else expected
+    assertion = (
+        f'(assert_return (invoke "run" {_u32_args([iters] + extra)}) '
+        f"(u32.const {result}))"
+    )
+    text = RUN_ASSERT.sub("", text).rstrip() + "\n" + assertion + "\n"
+    out = tmp / f"{Path(workload).stem}-{iters}.wast"
+    out.write_text(text, encoding="utf-8")
+    return out
+
+
+def _time_case(
+    wasmoon: Path, wast: Path, iterations: int, warmup: int
+) -> Tuple[float | None, List[str]]:
+    samples: List[float] = []
+    for i in range(warmup + iterations):
+        started = time.perf_counter()
+        result = run_file(wast, wasmoon)
+        elapsed = time.perf_counter() - started
+        if result["failed"]:
+            return None, list(result["failures"])
+        if i >= warmup:
+            samples.append(elapsed)
+    return statistics.median(samples), []
+
+
+def _compare_with_baseline(
+    summary: Dict[str, Any], baseline: Dict[str, Any], threshold_pct: float
+) -> Tuple[List[Dict[str, Any]], List[str]]:
+    findings: List[Dict[str, Any]] = []
+    failures: List[str] = []
+    cur_arch = summary["host"]["machine"]
+    base_arch = baseline.get("host", {}).get("machine", "")
+    if base_arch and cur_arch != base_arch:
+        failures.append(
+            f"Baseline arch mismatch: current={cur_arch}, baseline={base_arch}"
+        )
+        return findings, failures
+    baseline_rows = {row["case"]: row for row in baseline.get("cases", [])}
+    for row in summary["cases"]:
+        base = baseline_rows.get(row["case"])
+        if base is None or base.get("ns_per_op") is None:
+            findings.append({"case": row["case"], "status": "missing-baseline"})
+            continue
+        if row["ns_per_op"] is None:
+            findings.append({"case": row["case"], "status": "failed"})
+            continue
+        delta = (row["ns_per_op"] - base["ns_per_op"]) / base["ns_per_op"] * 100.0
+        status = "ok"
+        if delta > threshold_pct:
+            status = "regressed"
+            failures.append(
+                f"{row['case']}: {delta:.2f}% slower than baseline "
+                f"(> {threshold_pct:.2f}%)"
+            )
+        findings.append({"case": row["case"], "status": status, "delta_pct": delta})
+    return findings, failures
+
+
+def _write_markdown(summary: Dict[str, Any], out_path: Path) -> None:
+    lines = [
+        "# Wasmoon Component Call Benchmarks",
+        "",
+        f"- Host: `{summary['host']['system']} / {summary['host']['machine']}`",
+        f"- Iterations: `{summary['config']['iterations']}` "
+        f"(warmup `{summary['config']['warmup']}`), "
+        f"ops `{summary['config']['ops_lo']}` vs `{summary['config']['ops_hi']}`",
+        "",
+        "| Case | ns/op |",
+        "|---|---:|",
+    ]
+    for row in summary["cases"]:
+        ns = "-" if row["ns_per_op"] is None else f"{row['ns_per_op']:.0f}"
+        lines.append(f"| `{row['case']}` | {ns} |")
+    compare = summary.get("comparison")
+    if compare:
+        lines.extend(["", "## Baseline Comparison", "", "| Case | Status | Δ% |", "|---|---|---:|"])
+        for item in compare["findings"]:
+            delta = item.get("delta_pct")
+            lines.append(
+                f"| `{item['case']}` | {item['status']} | "
+                f"{'-' if delta is None else f'{delta:.2f}'} |"
+            )
+        if compare["failures"]:
+            lines.extend(["", "### Regression Failures", ""])
+            lines.extend(f"- {failure}" for failure in compare["failures"])
+    out_path.write_text("\n".join(lines) + "\n", encoding="utf-8")
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(
+        description="Benchmark cross-component calls through the canonical ABI."
+    )
+    parser.add_argument(
+        "--wasmoon", help="wasmoon binary (default: <repo>/wasmoon)"
+    )
+    parser.add_argument("--out-dir", default="target/perf-benchmarks/component-calls")
+    parser.add_argument("--case", action="append", dest="cases")
+    parser.add_argument("--ops-lo", type=int, default=100)
+    parser.add_argument("--ops-hi", type=int, default=10000)
+    parser.add_argument("--iterations", type=int, default=5)
+    parser.add_argument("--warmup", type=int, default=1)
+    parser.add_argument("--baseline", help="Optional baseline summary.json path")
+    parser.add_argument("--threshold-pct", type=float, default=15.0)
+    args = parser.parse_args()
+
+    repo_root = Path(__file__).resolve().parent.parent
+    wasmoon = Path(args.wasmoon) if args.wasmoon else repo_root / "wasmoon"
+    if not wasmoon.exists():
+        print(
+            "Error: wasmoon binary not found. "
+            "Run moon build --target native --release && ./install.sh first."
+        )
+        return 1
+
+    cases = [c for c in CASES if not args.cases or c[0] in args.cases]
+    rows: List[Dict[str, Any]] = []
+    collection_failures: List[str] = []
+    with tempfile.TemporaryDirectory(prefix="wasmoon_component_bench_") as tmp_dir:
+        tmp = Path(tmp_dir)
+        for name, workload, extra, expected in cases:
+            # The stream chain moves 64 KiB per op; keep its op counts small.
+            lo, hi = (args.ops_lo, args.ops_hi)
+            if expected is not None:
+                lo, hi = max(1, lo // 100), max(2, hi // 100)
+            timings: Dict[int, float | None] = {}
+            for ops in (lo, hi):
+                wast = _materialize(repo_root, tmp, workload, ops, extra, expected)
+                elapsed, failures = _time_case(wasmoon, wast, args.iterations, args.warmup)
+                timings[ops] = elapsed
+                for failure in failures:
+                    collection_failures.append(f"{name} (ops={ops}): {failure}")
+            ns_per_op = None
+            if timings[lo] is not None and timings[hi] is not None:
+                ns_per_op = (timings[hi] - timings[lo]) / (hi - lo) * 1e9
+            rows.append(
+                {
+                    "case": name,
+                    "workload": workload,
+                    "args": extra,
+                    "ops": [lo, hi],
+                    "elapsed_sec_median": [timings[lo], timings[hi]],
+                    "ns_per_op": ns_per_op,
+                }
+            )
+            shown = "failed" if ns_per_op is None else f"{ns_per_op:.0f} ns/op"
+            print(f"{name:<20} {shown}")
+
+    summary: Dict[str, Any] = {
+        "schema_version": 1,
+        "generated_at_unix_sec": int(time.time()),
+        "host": {
+            "system": platform.system(),
+            "machine": platform.machine(),
+            "python": platform.python_version(),
+        },
+        "config": {
+            "wasmoon": str(wasmoon),
+            "iterations": args.iterations,
+            "warmup": args.warmup,
+            "ops_lo": args.ops_lo,
+            "ops_hi": args.ops_hi,
+            "threshold_pct": args.threshold_pct,
+        },
+        "cases": rows,
+    }
+    if args.baseline:
+        baseline_path = Path(args.baseline)
+        if baseline_path.exists():
+            baseline = json.loads(baseline_path.read_text(encoding="utf-8"))
+            findings, failures = _compare_with_baseline(
+                summary, baseline, args.threshold_pct
+            )
+        else:
+            findings, failures = [], [f"Baseline file not found: {baseline_path}"]
+        summary["comparison"] = {
+            "baseline": str(baseline_path),
+            "findings": findings,
+            "failures": failures,
+        }
+
+    out_dir = Path(args.out_dir)
+    out_dir.mkdir(parents=True, exist_ok=True)
+    (out_dir / "summary.json").write_text(json.dumps(summary, indent=2), encoding="utf-8")
+    _write_markdown(summary, out_dir / "summary.md")
+
+    if collection_failures:
+        for failure in collection_failures:
+            print(f"[collect-failure] {failure}")
+        return 1
+    if summary.get("comparison", {}).get("failures"):
+        for failure in summary["comparison"]["failures"]:
+            print(f"[regression] {failure}")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+"""Measure component-model stream throughput on chained byte streams."""
+
+from __future__ import annotations
+
+import argparse
+import statistics
+import sys
+import time
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parent))
+
+from run_component_wast import run_file  # noqa: E402
+
+DEFAULT_WORKLOAD = "examples/component/stream_chain.wast"
+# Must match the invocation in the workload: 64 chunks * 4 hops * 64 KiB.
+DEFAULT_BYTES_MOVED = 64 * 4 * 65536
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(
+        description="Benchmark stream<u8> transfers between component buffers."
+    )
+    parser.add_argument("--workload", default=DEFAULT_WORKLOAD)
+    parser.add_argument("--bytes-moved", type=int, default=DEFAULT_BYTES_MOVED)
+    parser.add_argument("--iterations", type=int, default=5)
+    parser.add_argument("--warmup", type=int, default=1)
+    args = parser.parse_args()
+
+    repo_root = Path(__file__).resolve().parent.parent
+    wasmoon = repo_root / "wasmoon"
+    if not wasmoon.exists():
+        print(
+            "Error: wasmoon binary not found. "
+            "Run moon build --target native --release && ./install.sh first."
+        )
+        return 1
+    workload = repo_root / args.workload
+
+    samples: list[float] = []
+    for i in range(args.warmup + args.iterations):
+        started = time.perf_counter()
+        result = run_file(workload, wasmoon)
+        elapsed = time.perf_counter() - started
+        if result["failed"]:
+            for failure in result["failures"]:
+                print(f"[FAIL] {failure}")
+            return 1
+        if i >= args.warmup:
+            samples.append(elapsed)
+
+    median = statistics.median(samples)
+    mib = args.bytes_moved / (1024 * 1024)
+    # Wall time includes `wasm-tools parse`, validation and instantiation, so
+    # the MiB/s figure is a lower bound on the raw copy throughput.
+    print(f"workload:   {args.workload}")
+    print(f"moved:      {mib:.1f} MiB")
+    print(f"median:     {median * 1000:.1f} ms over {len(samples)} run(s)")
+    print(f"throughput: {mib / median:.1f} MiB/s")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -68,3 +68,89 @@ MOONBIT_FFI_EXPORT int wasmoon_host_arch(void) {
   return -1;
 #endif
 }
+
+// ============ x86-64 CPU features ============
+
+#if defined(__x86_64__) || defined(__x86_64) || defined(__amd64__) || defined(__amd64) || \
+  defined(_M_X64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+static void wasmoon_cpuid(unsigned int leaf, unsigned int sub, unsigned int regs[4]) {
+  int r[4];
+  __cpuidex(r, (int)leaf, (int)sub);
+  for (int i = 0; i < 4; i++) {
+    regs[i] = (unsigned int)r[i];
+  }
+}
+static unsigned long long wasmoon_xgetbv0(void) {
+  return (unsigned long long)_xgetbv(0);
+}
+#else
+#include <cpuid.h>
+static void wasmoon_cpuid(unsigned int leaf, unsigned int sub, unsigned int regs[4]) {
+  __cpuid_count(leaf, sub, regs[0], regs[1], regs[2], regs[3]);
+}
+static unsigned long long wasmoon_xgetbv0(void) {
+  unsigned int lo, hi;
+  __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+  return ((unsigned long long)hi << 32) | lo;
+}
+#endif
+#define WASMOON_HAVE_CPUID 1
+#endif
+
+// Feature bits (keep in sync with vcode/isa/cpu_features.mbt):
+//   bit 0: POPCNT  (CPUID.1:ECX[23])
+//   bit 1: LZCNT   (CPUID.80000001h:ECX[5])
+//   bit 2: BMI1    (CPUID.(7,0):EBX[3]) - tzcnt, andn
+//   bit 3: BMI2    (CPUID.(7,0):EBX[8]) - shlx/shrx/sarx, rorx
+//   bit 4: AVX     (CPUID.1:ECX[28], with OSXSAVE and XMM/YMM state enabled
+//                   in XCR0) - VEX-encoded SSE
+//   bit 5: AVX2    (CPUID.(7,0):EBX[5], only together with AVX) - vpbroadcast*
+//   bit 6: FMA     (CPUID.1:ECX[12], only together with AVX) - vfmadd*
+// Always 0 on non-x86-64 hosts.
+MOONBIT_FFI_EXPORT int wasmoon_host_cpu_features(void) {
+#if defined(WASMOON_HAVE_CPUID)
+  unsigned int regs[4] = {0, 0, 0, 0};
+  int features = 0;
+  wasmoon_cpuid(0, 0, regs);
+  unsigned int max_leaf = regs[0];
+  wasmoon_cpuid(0x80000000u, 0, regs);
+  unsigned int max_ext_leaf = regs[0];
+  if (max_leaf >= 1) {
+    wasmoon_cpuid(1, 0, regs);
+    if (regs[2] & (1u << 23)) {
+      features |= 1 << 0;
+    }
+    // AVX needs OS support for saving the YMM state, not just the CPU bit.
+    if ((regs[2] & (1u << 28)) && (regs[2] & (1u << 27)) &&
+        (wasmoon_xgetbv0() & 6) == 6) {
+      features |= 1 << 4;
+    }
+    if ((regs[2] & (1u << 12)) && (features & (1 << 4))) {
+      features |= 1 << 6;
+    }
+  }
+  if (max_ext_leaf >= 0x80000001u) {
+    wasmoon_cpuid(0x80000001u, 0, regs);
+    if (regs[2] & (1u << 5)) {
+      features |= 1 << 1;
+    }
+  }
+  if (max_leaf >= 7) {
+    wasmoon_cpuid(7, 0, regs);
+    if (regs[1] & (1u << 3)) {
+      features |= 1 << 2;
+    }
+    if (regs[1] & (1u << 8)) {
+      features |= 1 << 3;
+    }
+    if ((regs[1] & (1u << 5)) && (features & (1 << 4))) {
+      features |= 1 << 5;
+    }
+  }
+  return features;
+#else
+  return 0;
+#endif
+}